@@ -85,8 +85,10 @@ SOURCES      := utility/src/align/align-ksw2-driver.C \
                 correction/falconConsensus-alignTag.C \
                 \
                 stores/sqCache.C \
+                stores/sqCache-packing.C \
                 stores/sqLibrary.C \
                 stores/sqReadData.C \
+                stores/sqReadData-codec.C \
                 stores/sqReadDataWriter.C \
                 stores/sqStore.C \
                 stores/sqStoreBlob.C \
@@ -94,10 +96,12 @@ SOURCES      := utility/src/align/align-ksw2-driver.C \
                 stores/sqStoreInfo.C \
                 \
                 stores/ovOverlap.C \
+                stores/ovOverlapBlock.C \
                 stores/ovStore.C \
                 stores/ovStoreWriter.C \
                 stores/ovStoreFilter.C \
                 stores/ovStoreFile.C \
+                stores/ovStoreSort.C \
                 stores/ovStoreHistogram.C \
                 \
                 stores/tgStore.C \
@@ -119,7 +123,9 @@ SOURCES      := utility/src/align/align-ksw2-driver.C \
                 overlapInCore/liboverlap/prefixEditDistance-allocateMoreSpace.C \
                 overlapInCore/liboverlap/prefixEditDistance-extend.C \
                 overlapInCore/liboverlap/prefixEditDistance-forward.C \
+                overlapInCore/liboverlap/prefixEditDistance-matchLength.C \
                 overlapInCore/liboverlap/prefixEditDistance-reverse.C \
+                overlapInCore/liboverlap/edlibAligner.C \
                 \
                 gfa/gfa.C \
                 gfa/bed.C
@@ -206,6 +212,7 @@ SUBMAKEFILES := stores/dumpBlob.mk \
                 stores/ovStoreBucketizer.mk \
                 stores/ovStoreSorter.mk \
                 stores/ovStoreIndexer.mk \
+                stores/ovStoreAppend.mk \
                 stores/ovStoreDump.mk \
                 stores/ovStoreStats.mk \
                 stores/sqStoreCreate.mk \
@@ -229,6 +236,7 @@ SUBMAKEFILES := stores/dumpBlob.mk \
                 overlapInCore/overlapImport.mk \
                 overlapInCore/overlapPair.mk \
                 overlapInCore/edalign.mk \
+                overlapInCore/liboverlap/prefixEditDistance-benchmark.mk \
                 \
                 mhap/mhapConvert.mk \
                 \
@@ -259,6 +267,7 @@ SUBMAKEFILES := stores/dumpBlob.mk \
                 \
                 utgcns/utgcns.mk \
                 utgcns/layoutToPackage.mk \
+                utgcns/alnGraph-benchmark.mk \
                 \
                 gfa/alignGFA.mk
 
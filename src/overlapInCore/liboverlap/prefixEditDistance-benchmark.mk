@@ -0,0 +1,8 @@
+TARGET   := prefixEditDistance-benchmark
+SOURCES  := prefixEditDistance-benchmark.C
+
+SRC_INCDIRS  := ../../utility/src ../../stores ..
+
+TGT_LDFLAGS := -L${TARGET_DIR}/lib
+TGT_LDLIBS  := -l${MODULE}
+TGT_PREREQS := lib${MODULE}.a
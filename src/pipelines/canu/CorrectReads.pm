@@ -400,6 +400,7 @@ sub generateCorrectedReadsConfigure ($) {
         print F "\n";
         print F "bgnid=0\n";
         print F "endid=0\n";
+        print F "workers=" . getGlobal("corThreads") . "\n";
         print F "\n";
 
         my $nJobs = 0;
@@ -411,12 +412,13 @@ sub generateCorrectedReadsConfigure ($) {
             s/^\s+//;
             s/\s+$//;
 
-            my ($jobID, $bgnID, $endID, $nReads, $reqmem) = split '\s+', $_;
+            my ($jobID, $bgnID, $endID, $nReads, $reqmem, $workers) = split '\s+', $_;
 
             print  F "if [ \$jobid -eq $jobID ] ; then\n";
             printf F "  jobid=%04d\n", $jobID;   #  Parsed in Check() below.
             print  F "  bgnid=$bgnID\n";
             print  F "  endid=$endID\n";
+            print  F "  workers=$workers\n"   if (defined($workers));   #  Not in old batches files.
             print  F "fi\n";
 
             $nJobs = $jobID;
@@ -476,6 +478,7 @@ sub generateCorrectedReadsConfigure ($) {
         print F "  -R ./$asm.readsToCorrect \\\n"   if ( fileExists("$path/$asm.readsToCorrect"));
         print F "  -r \$bgnid-\$endid \\\n";
         print F "  -t  " .        getGlobal("corThreads")       . " \\\n";
+        print F "  -w  \$workers \\\n";
         print F "  -cc " .        getGlobal("corMinCoverage")   . " \\\n";
         print F "  -cl " .        getGlobal("minReadLength")    . " \\\n";
         print F "  -oi " . (1.0 - getGlobal("corErrorRate"))    . " \\\n";
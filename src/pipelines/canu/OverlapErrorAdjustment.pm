@@ -209,7 +209,8 @@ sub readErrorDetectionConfigure ($) {
         #
         #  Per base/vote:
         #    1 byte  for sequence
-        #   32 bytes for Vote_Tally_t // why 32 made up number, why random 4 gb padding?
+        #   18 bytes for Vote_Tally_t
+        #   ~1 insertion vote (16 bytes plus the inserted bases) at high coverage
         #
         #  Per read:
         #   32 bytes for Frag_Info_t
@@ -225,7 +226,7 @@ sub readErrorDetectionConfigure ($) {
         #
         #  Throw in another 2 GB for unknown overheads (seqStore, ovlStore) and alignment generation.
 
-        my $memory = (128 * $bases) + (33 * $reads) + (12 * $olaps) + (2 * $maxBlockSize) + 2 * 1024 * 1024 * 1024;
+        my $memory = (40 * $bases) + (33 * $reads) + (12 * $olaps) + (2 * $maxBlockSize) + 2 * 1024 * 1024 * 1024;
 
         if ((($maxMem   > 0) && ($memory >= $maxMem))    ||
             (($maxReads > 0) && ($reads  >= $maxReads))  ||
@@ -240,7 +241,7 @@ sub readErrorDetectionConfigure ($) {
                    $memory / 1024 / 1024,
                    $bgn[$nj], $end[$nj],
                    $reads,
-                   $bases,               (128 * $bases + 33 * $reads)  / 1024 / 1024,
+                   $bases,               (40 * $bases + 33 * $reads)   / 1024 / 1024,
                    $olaps,               (12 * $olaps)                / 1024 / 1024,
                    2 * $maxBlockSize / 1024 / 1024);
 
@@ -612,6 +613,7 @@ sub overlapErrorAdjustmentConfigure ($) {
     print F "  -l " . getGlobal("minOverlapLength") . " \\\n";
     print F "  -s \\\n"   if (getGlobal("oeaMaskTrivial") != 0);
     print F "  -c ./red.red \\\n";
+    print F "  -t " . getGlobal("oeaThreads") . " \\\n";
     print F "  -o ./\$jobid.oea.WORKING \\\n";
     print F "&& \\\n";
     print F "mv ./\$jobid.oea.WORKING ./\$jobid.oea\n";
@@ -144,6 +144,7 @@ sub createOverlapStoreSequential ($$$) {
         print F " -O  ./$asm.ovlStore.BUILDING \\\n";
         print F" -S ../$asm.seqStore \\\n";
         print F " -C  ./$asm.ovlStore.config \\\n";
+        print F " -t  " . getGlobal("ovsThreads") . " \\\n";
         print F " > ./$asm.ovlStore.err 2>&1 \\\n";
         print F "&& \\\n";
         print F "mv ./$asm.ovlStore.BUILDING ./$asm.ovlStore\n";
@@ -365,6 +366,7 @@ sub createOverlapStoreParallel ($$$$$$) {
         print F "  -C  ./$asm.ovlStore.config \\\n";
         print F "  -f \\\n";
         print F "  -s \$jobid \\\n";
+        print F "  -t " . getGlobal("ovsThreads") . " \\\n";
         print F "  -M $sortMemory \n";
         print F "\n";
 
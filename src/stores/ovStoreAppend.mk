@@ -0,0 +1,8 @@
+TARGET   := ovStoreAppend
+SOURCES  := ovStoreAppend.C
+
+SRC_INCDIRS := ../utility/src
+
+TGT_LDFLAGS := -L${TARGET_DIR}/lib
+TGT_LDLIBS  := -l${MODULE}
+TGT_PREREQS := lib${MODULE}.a
@@ -0,0 +1,10 @@
+TARGET   := alnGraph-benchmark
+SOURCES  := alnGraph-benchmark.C \
+            unitigConsensus.C \
+            libpbutgcns/AlnGraphBoost.C
+
+SRC_INCDIRS  := ../utility/src ../stores libpbutgcns
+
+TGT_LDFLAGS := -L${TARGET_DIR}/lib
+TGT_LDLIBS  := -l${MODULE}
+TGT_PREREQS := lib${MODULE}.a
@@ -1,19 +0,0 @@
-/*
-Copyright Rene Rivera 2013
-Copyright (c) Microsoft Corporation 2014
-Distributed under the Boost Software License, Version 1.0.
-(See accompanying file LICENSE_1_0.txt or copy at
-http://www.boost.org/LICENSE_1_0.txt)
-*/
-
-#ifndef BOOST_PREDEF_PLATFORM_H
-#define BOOST_PREDEF_PLATFORM_H
-
-#include <boost/predef/platform/mingw.h>
-#include <boost/predef/platform/windows_desktop.h>
-#include <boost/predef/platform/windows_store.h>
-#include <boost/predef/platform/windows_phone.h>
-#include <boost/predef/platform/windows_runtime.h>
-/*#include <boost/predef/platform/.h>*/
-
-#endif